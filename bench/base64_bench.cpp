@@ -0,0 +1,63 @@
+// MIT License
+//
+// Copyright (c) 2023 Piotr Pszczółkowski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "../share.h"
+#include <chrono>
+#include <fmt/core.h>
+
+// Porównanie base64/base64url z bytes_as_str dla tych samych danych. \n
+// bytes_as_str (join_strings) ma złożoność kwadratową, więc wywoływana jest mniej razy.
+int main() {
+    unsigned const runs = 1000;
+    unsigned const bytes_as_str_runs = 5;
+
+    for (auto const n: {64, 1024, 64 * 1024}) {
+        auto const data = share::random_bytes(n);
+        auto const text = share::base64_encode(data);
+        auto const text_url = share::base64url_encode(data);
+        std::vector<char> text_buffer(share::base64_encoded_size(data.size()));
+        std::vector<u8> data_buffer(data.size());
+
+        fmt::print("payload: {} bytes (runs: {}, bytes_as_str runs: {})\n",
+                   share::number2str(n), runs, bytes_as_str_runs);
+        fmt::print("  bytes_as_str (HEX):     {}\n", share::execution_timer([&] {
+            return share::bytes_as_str(data);
+        }, bytes_as_str_runs));
+        fmt::print("  base64_encode:          {}\n", share::execution_timer([&] {
+            return share::base64_encode(data);
+        }, runs));
+        fmt::print("  base64_encode (buffer): {}\n", share::execution_timer([&] {
+            return share::base64_encode(data, text_buffer);
+        }, runs));
+        fmt::print("  base64url_encode:       {}\n", share::execution_timer([&] {
+            return share::base64url_encode(data);
+        }, runs));
+        fmt::print("  base64_decode:          {}\n", share::execution_timer([&] {
+            return share::base64_decode(text);
+        }, runs));
+        fmt::print("  base64_decode (buffer): {}\n", share::execution_timer([&] {
+            return share::base64_decode(text, data_buffer);
+        }, runs));
+        fmt::print("  base64url_decode:       {}\n", share::execution_timer([&] {
+            return share::base64url_decode(text_url);
+        }, runs));
+    }
+}
@@ -22,7 +22,9 @@
 #pragma once
 #include <iostream>
 #include <string>
+#include <atomic>
 #include <cstdint>
+#include <ctime>
 #include <sstream>
 #include <date/date.h>
 #include <date/tz.h>
@@ -59,9 +61,15 @@ struct tm_t {
 };
 
 class daytime_t final {
-    date::time_zone const* zone = date::locate_zone("Europe/Warsaw");
+    date::time_zone const* zone = default_zone();
     zoned_time_t tp_{};
 public:
+    /// Strefa czasowa używana przez daytime_t (wyszukiwana tylko raz).
+    static date::time_zone const* default_zone() {
+        static auto const tz = date::locate_zone("Europe/Warsaw");
+        return tz;
+    }
+
     /// Data-czas teraz (now).
     daytime_t() {
         auto const now = std::chrono::system_clock::now();
@@ -274,3 +282,111 @@ private:
         return make_zoned(zone, t);
     }
 };
+
+/// Data-czas "teraz" w postaci gotowej do użycia (timestamp i składniki czasu lokalnego).
+struct now_t {
+    i64 timestamp{};
+    dt_t dt{};
+    tm_t tm{};
+};
+
+/// Zegar "teraz" z dokładnością do sekundy dla częstych odczytów (np. logi). \n
+/// Czas pobierany jest z zegara zgrubnego (CLOCK_REALTIME_COARSE, jeśli dostępny),
+/// a konwersja do strefy czasowej wykonywana jest tylko raz na sekundę. \n
+/// Wynik przechowywany jest we wspólnej migawce chronionej seqlock'iem -
+/// odczyt nie blokuje i nie powtarza konwersji. \n
+/// Migawka nigdy nie jest cofana przez spóźniony wątek; cofnięcie zegara
+/// systemowego jest rozpoznawane ponownym odczytem zegara.
+class daytime_clock final {
+public:
+    /// Data-czas teraz (z migawki).
+    /// \return timestamp i składniki daty-czasu lokalnego.
+    [[nodiscard]] static now_t
+    now() {
+        auto ts = coarse_timestamp();
+        auto& snap = snapshot();
+        for (;;) {
+            auto seq = snap.seq.load(std::memory_order_acquire);
+            if (seq & 1)
+                continue;   // Trwa aktualizacja migawki.
+
+            auto const current = snap.load();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (snap.seq.load(std::memory_order_relaxed) != seq)
+                continue;   // Migawka zmieniła się w trakcie odczytu.
+            if (current.timestamp == ts)
+                return current;
+            if (current.timestamp > ts) {
+                // Migawka jest nowsza od naszego odczytu: albo wątek się spóźnił
+                // (np. został wywłaszczony), albo zegar został cofnięty.
+                // Ponowny odczyt zegara rozstrzyga - spóźniony wątek nie cofa migawki.
+                if (auto const again = coarse_timestamp(); again != ts) {
+                    ts = again;
+                    continue;
+                }
+                // Zegar rzeczywiście został cofnięty - migawka przyjmuje starszą sekundę.
+            }
+
+            // Konwersja poza sekcją zapisu - czytelnicy nie czekają na nią,
+            // a ewentualny wyjątek (np. brak bazy stref) nie blokuje seqlock'a.
+            auto const [dt, tm] = daytime_t(ts).components();
+            now_t const fresh{ts, dt, tm};
+
+            // Publikacja tylko jeśli migawka nie zmieniła się w międzyczasie.
+            if (snap.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_relaxed)) {
+                std::atomic_thread_fence(std::memory_order_release);
+                snap.store(fresh);
+                snap.seq.store(seq + 2, std::memory_order_release);
+                return fresh;
+            }
+        }
+    }
+    /// Data-czas teraz jako obiekt daytime_t (bez odczytu zegara systemowego
+    /// i bez ponownego wyszukiwania strefy czasowej).
+    [[nodiscard]] static daytime_t
+    daytime() {
+        auto const tp = date::sys_seconds{std::chrono::seconds{now().timestamp}};
+        return daytime_t(date::make_zoned(daytime_t::default_zone(), tp));
+    }
+    /// Liczba sekund od początku epoki z zegara zgrubnego.
+    [[nodiscard]] static i64
+    coarse_timestamp() noexcept {
+#if defined(CLOCK_REALTIME_COARSE)
+        timespec ts{};
+        clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+        return static_cast<i64>(ts.tv_sec);
+#else
+        namespace chrono = std::chrono;
+        auto const now = chrono::system_clock::now();
+        return static_cast<i64>(chrono::floor<chrono::seconds>(now).time_since_epoch().count());
+#endif
+    }
+private:
+    struct snapshot_t {
+        std::atomic<unsigned> seq{0};
+        std::atomic<i64> timestamp{-1};
+        std::atomic<int> y{}, mon{}, d{};
+        std::atomic<int> h{}, min{}, s{};
+
+        [[nodiscard]] now_t load() const noexcept {
+            return {
+                timestamp.load(std::memory_order_relaxed),
+                {y.load(std::memory_order_relaxed), mon.load(std::memory_order_relaxed), d.load(std::memory_order_relaxed)},
+                {h.load(std::memory_order_relaxed), min.load(std::memory_order_relaxed), s.load(std::memory_order_relaxed)}
+            };
+        }
+        void store(now_t const& v) noexcept {
+            timestamp.store(v.timestamp, std::memory_order_relaxed);
+            y.store(v.dt.y, std::memory_order_relaxed);
+            mon.store(v.dt.m, std::memory_order_relaxed);
+            d.store(v.dt.d, std::memory_order_relaxed);
+            h.store(v.tm.h, std::memory_order_relaxed);
+            min.store(v.tm.m, std::memory_order_relaxed);
+            s.store(v.tm.s, std::memory_order_relaxed);
+        }
+    };
+    static snapshot_t& snapshot() noexcept {
+        static snapshot_t snap{};
+        return snap;
+    }
+};
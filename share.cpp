@@ -26,6 +26,10 @@
 #include <charconv>
 #include <range/v3/all.hpp>
 #include <fmt/core.h>
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SHARE_BASE64_AVX2 1
+#include <immintrin.h>
+#endif
 
 
 /// Zamienia ciąg bajtów typu 'u8' na string.
@@ -114,6 +118,35 @@ splitv(std::string_view sv, char const delimiter) noexcept {
     return tokens;
 }
 
+/// Podział przysłanego stringa na wektor widoków wg delimiter'a wieloznakowego (np. "||", "\r\n"). \n
+/// Wynik jest taki sam jak dla splitv z jednym delimiter'em.
+/// \param text - string do podziału,
+/// \param delimiter - ciąg znaków sygnalizujący podział,
+/// \return Wektor widoków.
+std::vector<std::string_view> share::
+splitv(std::string_view sv, std::string_view const delimiter) noexcept {
+    if (delimiter.empty()) {
+        if (sv.empty())
+            return {};
+        return {trimv_right(sv)};
+    }
+    if (delimiter.size() == 1)
+        return splitv(sv, delimiter.front());
+
+    std::vector<std::string_view> tokens{};
+
+    auto pos = sv.find(delimiter);
+    while (pos != std::string_view::npos) {
+        tokens.push_back(trimv_right({sv.data(), sv.data() + pos}));
+        sv.remove_prefix(pos + delimiter.size());
+        pos = sv.find(delimiter);
+    }
+    if (sv.data() != sv.end())
+        tokens.push_back(trimv_right({sv.data(), sv.end()}));
+
+    return tokens;
+}
+
 /// Podział przysłanego stringa na wektor stringów. \n
 /// Wyodrębnianie stringów składowych odbywa się po napotkaniu delimiter'a.
 /// \param text - string do podziału,
@@ -232,3 +265,327 @@ vec2str(std::span<char> vec) noexcept {
             | ranges::views::transform([](char c) { return c; })
             | ranges::to<std::string>();
 }
+
+namespace {
+    /// Alfabet base64 - różnice dotyczą tylko wartości 62 i 63.
+    struct base64_alphabet_t {
+        std::array<char, 64> chars{};
+        std::array<u8, 256> values{};
+        bool pad{};
+    };
+
+    constexpr base64_alphabet_t
+    make_base64_alphabet(char const c62, char const c63, bool const pad) noexcept {
+        base64_alphabet_t a{};
+        constexpr std::string_view common = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+        for (size_t i = 0; i < common.size(); i++)
+            a.chars[i] = common[i];
+        a.chars[62] = c62;
+        a.chars[63] = c63;
+        // 0xff oznacza znak spoza alfabetu.
+        for (auto& v: a.values)
+            v = 0xff;
+        for (size_t i = 0; i < a.chars.size(); i++)
+            a.values[static_cast<u8>(a.chars[i])] = static_cast<u8>(i);
+        a.pad = pad;
+        return a;
+    }
+
+    constexpr auto base64_std = make_base64_alphabet('+', '/', true);
+    constexpr auto base64_url = make_base64_alphabet('-', '_', false);
+
+#if SHARE_BASE64_AVX2
+    bool has_avx2() noexcept {
+        static bool const supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+
+    /// Kodowanie AVX2: 24 bajty -> 32 znaki na iterację.
+    /// \return liczba przetworzonych bajtów (wielokrotność 3).
+    __attribute__((target("avx2"))) size_t
+    base64_encode_avx2(u8 const* src, size_t const n, char* dst, base64_alphabet_t const& alphabet) noexcept {
+        // Każda 128-bitowa połówka dostaje 12 bajtów wejścia ułożonych po 3 w 32-bitowych słowach.
+        __m256i const shuffle = _mm256_setr_epi8(
+                1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        // Przesunięcia dodawane do 6-bitowych wartości (A-Z, a-z, 0-9, 62, 63).
+        auto const off62 = static_cast<char>(alphabet.chars[62] - 62);
+        auto const off63 = static_cast<char>(alphabet.chars[63] - 63);
+        __m256i const offsets = _mm256_setr_epi8(
+                65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, off62, off63, 0, 0,
+                65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, off62, off63, 0, 0);
+
+        size_t i = 0;
+        // Ładujemy 16 bajtów od src + i + 12, stąd zapas 4 bajtów.
+        for (; i + 28 <= n; i += 24) {
+            auto const lo = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+            auto const hi = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i + 12));
+            auto in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+            in = _mm256_shuffle_epi8(in, shuffle);
+
+            // Rozdzielenie 3 bajtów na 4 wartości 6-bitowe.
+            auto const t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+            auto const t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            auto const t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+            auto const t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            auto const indices = _mm256_or_si256(t1, t3);
+
+            // Wybór przesunięcia: 0..25 -> 0, 26..51 -> 1, 52..61 -> 2..11, 62 -> 12, 63 -> 13.
+            auto lut_idx = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            lut_idx = _mm256_sub_epi8(lut_idx, _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)));
+            auto const out = _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, lut_idx));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), out);
+            dst += 32;
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2"))) inline __m256i
+    in_range_avx2(__m256i const in, char const lo, char const hi) noexcept {
+        return _mm256_and_si256(
+                _mm256_cmpgt_epi8(in, _mm256_set1_epi8(static_cast<char>(lo - 1))),
+                _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi + 1)), in));
+    }
+
+    /// Dekodowanie AVX2: 32 znaki -> 24 bajty na iterację. \n
+    /// Zatrzymuje się na bloku z niepoprawnym znakiem - resztę (i błąd) obsługuje wersja skalarna.
+    /// \return liczba przetworzonych znaków (wielokrotność 32).
+    __attribute__((target("avx2"))) size_t
+    base64_decode_avx2(char const* src, size_t const n, u8* dst, base64_alphabet_t const& alphabet) noexcept {
+        size_t i = 0;
+        // Zapisujemy 32 bajty (24 użyteczne), stąd zapas na wejściu.
+        for (; i + 48 <= n; i += 32) {
+            auto const in = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + i));
+
+            auto const upper = in_range_avx2(in, 'A', 'Z');
+            auto const lower = in_range_avx2(in, 'a', 'z');
+            auto const digit = in_range_avx2(in, '0', '9');
+            auto const is62 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(alphabet.chars[62]));
+            auto const is63 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(alphabet.chars[63]));
+
+            auto const valid = _mm256_or_si256(
+                    _mm256_or_si256(upper, lower),
+                    _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+            if (_mm256_movemask_epi8(valid) != -1)
+                break;
+
+            auto offset = _mm256_and_si256(upper, _mm256_set1_epi8(-65));
+            offset = _mm256_or_si256(offset, _mm256_and_si256(lower, _mm256_set1_epi8(-71)));
+            offset = _mm256_or_si256(offset, _mm256_and_si256(digit, _mm256_set1_epi8(4)));
+            auto values = _mm256_and_si256(
+                    _mm256_add_epi8(in, offset),
+                    _mm256_or_si256(upper, _mm256_or_si256(lower, digit)));
+            values = _mm256_or_si256(values, _mm256_and_si256(is62, _mm256_set1_epi8(62)));
+            values = _mm256_or_si256(values, _mm256_and_si256(is63, _mm256_set1_epi8(63)));
+
+            // Złożenie 4 wartości 6-bitowych w 3 bajty.
+            auto const merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+            auto packed = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+            packed = _mm256_shuffle_epi8(packed, _mm256_setr_epi8(
+                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+            packed = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), packed);
+            dst += 24;
+        }
+        return i;
+    }
+#endif
+
+    /// Kodowanie do bufora o wystarczającym rozmiarze.
+    /// \return liczba zapisanych znaków.
+    size_t
+    base64_encode_to(std::span<u8 const> data, char* dst, base64_alphabet_t const& alphabet) noexcept {
+        auto src = data.data();
+        auto n = data.size();
+        auto out = dst;
+
+#if SHARE_BASE64_AVX2
+        if (has_avx2()) {
+            auto const done = base64_encode_avx2(src, n, out, alphabet);
+            src += done;
+            n -= done;
+            out += done / 3 * 4;
+        }
+#endif
+        auto const& chars = alphabet.chars;
+        size_t i = 0;
+        for (; i + 3 <= n; i += 3) {
+            auto const v = (u32{src[i]} << 16) | (u32{src[i + 1]} << 8) | u32{src[i + 2]};
+            *out++ = chars[v >> 18];
+            *out++ = chars[(v >> 12) & 0x3f];
+            *out++ = chars[(v >> 6) & 0x3f];
+            *out++ = chars[v & 0x3f];
+        }
+        if (auto const rest = n - i; rest != 0) {
+            auto v = u32{src[i]} << 16;
+            if (rest == 2)
+                v |= u32{src[i + 1]} << 8;
+            *out++ = chars[v >> 18];
+            *out++ = chars[(v >> 12) & 0x3f];
+            if (rest == 2)
+                *out++ = chars[(v >> 6) & 0x3f];
+            else if (alphabet.pad)
+                *out++ = '=';
+            if (alphabet.pad)
+                *out++ = '=';
+        }
+        return out - dst;
+    }
+
+    std::optional<size_t>
+    base64_encode_to(std::span<u8 const> data, std::span<char> out, base64_alphabet_t const& alphabet) noexcept {
+        auto const needed = alphabet.pad
+                ? share::base64_encoded_size(data.size())
+                : share::base64url_encoded_size(data.size());
+        if (out.size() < needed)
+            return {};
+        return base64_encode_to(data, out.data(), alphabet);
+    }
+
+    std::string
+    base64_encode_str(std::span<u8 const> data, base64_alphabet_t const& alphabet) noexcept {
+        std::string text(alphabet.pad
+                ? share::base64_encoded_size(data.size())
+                : share::base64url_encoded_size(data.size()), '\0');
+        base64_encode_to(data, text.data(), alphabet);
+        return text;
+    }
+
+    /// Dekodowanie ze ścisłą kontrolą poprawności tekstu.
+    /// \return liczba zapisanych bajtów lub brak wartości (niepoprawny tekst, za mały bufor).
+    std::optional<size_t>
+    base64_decode_to(std::string_view text, std::span<u8> out, base64_alphabet_t const& alphabet) noexcept {
+        // Dopełnienie: najwyżej dwa znaki '=' i tylko przy długości podzielnej przez 4.
+        size_t pads = 0;
+        while (pads < text.size() && text[text.size() - 1 - pads] == '=')
+            pads++;
+        if (pads > 2)
+            return {};
+        if ((pads || alphabet.pad) && text.size() % 4)
+            return {};
+        text.remove_suffix(pads);
+        if (text.size() % 4 == 1)
+            return {};
+
+        auto const needed = share::base64_decoded_size(text);
+        if (out.size() < needed)
+            return {};
+
+        auto src = text.data();
+        auto n = text.size();
+        auto dst = out.data();
+
+#if SHARE_BASE64_AVX2
+        if (has_avx2()) {
+            auto const done = base64_decode_avx2(src, n, dst, alphabet);
+            src += done;
+            n -= done;
+            dst += done / 4 * 3;
+        }
+#endif
+        auto const& values = alphabet.values;
+        auto const value = [&values](char const c) { return u32{values[static_cast<u8>(c)]}; };
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            auto const a = value(src[i]);
+            auto const b = value(src[i + 1]);
+            auto const c = value(src[i + 2]);
+            auto const d = value(src[i + 3]);
+            // Znak spoza alfabetu ma wartość 0xff.
+            if ((a | b | c | d) & 0x80)
+                return {};
+            auto const v = (a << 18) | (b << 12) | (c << 6) | d;
+            *dst++ = static_cast<u8>(v >> 16);
+            *dst++ = static_cast<u8>(v >> 8);
+            *dst++ = static_cast<u8>(v);
+        }
+        if (auto const rest = n - i; rest != 0) {
+            auto const a = value(src[i]);
+            auto const b = value(src[i + 1]);
+            auto const c = (rest == 3) ? value(src[i + 2]) : 0;
+            if ((a | b | c) & 0x80)
+                return {};
+            // Nieużywane bity ostatniego znaku muszą być zerowe.
+            if ((rest == 2 && (b & 0x0f)) || (rest == 3 && (c & 0x03)))
+                return {};
+            auto const v = (a << 18) | (b << 12) | (c << 6);
+            *dst++ = static_cast<u8>(v >> 16);
+            if (rest == 3)
+                *dst++ = static_cast<u8>(v >> 8);
+        }
+        return needed;
+    }
+
+    std::optional<std::vector<u8>>
+    base64_decode_vec(std::string_view text, base64_alphabet_t const& alphabet) noexcept {
+        std::vector<u8> data(share::base64_decoded_size(text));
+        if (!base64_decode_to(text, data, alphabet))
+            return {};
+        return data;
+    }
+
+    std::span<u8 const>
+    as_bytes(std::string_view sv) noexcept {
+        return {reinterpret_cast<u8 const*>(sv.data()), sv.size()};
+    }
+}
+
+/// Kodowanie bajtów w base64 (RFC 4648, z dopełnieniem '=').
+std::string share::
+base64_encode(std::span<u8 const> data) noexcept {
+    return base64_encode_str(data, base64_std);
+}
+std::string share::
+base64_encode(std::string_view data) noexcept {
+    return base64_encode_str(as_bytes(data), base64_std);
+}
+std::optional<size_t> share::
+base64_encode(std::span<u8 const> data, std::span<char> out) noexcept {
+    return base64_encode_to(data, out, base64_std);
+}
+std::optional<size_t> share::
+base64_encode(std::string_view data, std::span<char> out) noexcept {
+    return base64_encode_to(as_bytes(data), out, base64_std);
+}
+
+/// Kodowanie bajtów w base64url (RFC 4648 §5, bez dopełnienia).
+std::string share::
+base64url_encode(std::span<u8 const> data) noexcept {
+    return base64_encode_str(data, base64_url);
+}
+std::string share::
+base64url_encode(std::string_view data) noexcept {
+    return base64_encode_str(as_bytes(data), base64_url);
+}
+std::optional<size_t> share::
+base64url_encode(std::span<u8 const> data, std::span<char> out) noexcept {
+    return base64_encode_to(data, out, base64_url);
+}
+std::optional<size_t> share::
+base64url_encode(std::string_view data, std::span<char> out) noexcept {
+    return base64_encode_to(as_bytes(data), out, base64_url);
+}
+
+/// Dekodowanie tekstu base64 (dopełnienie '=' wymagane).
+std::optional<std::vector<u8>> share::
+base64_decode(std::string_view text) noexcept {
+    return base64_decode_vec(text, base64_std);
+}
+std::optional<size_t> share::
+base64_decode(std::string_view text, std::span<u8> out) noexcept {
+    return base64_decode_to(text, out, base64_std);
+}
+
+/// Dekodowanie tekstu base64url (dopełnienie '=' opcjonalne).
+std::optional<std::vector<u8>> share::
+base64url_decode(std::string_view text) noexcept {
+    return base64_decode_vec(text, base64_url);
+}
+std::optional<size_t> share::
+base64url_decode(std::string_view text, std::span<u8> out) noexcept {
+    return base64_decode_to(text, out, base64_url);
+}
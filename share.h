@@ -20,11 +20,14 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 #pragma once
+#include <array>
+#include <algorithm>
 #include <cstdint>
 #include <filesystem>
 #include <vector>
 #include <string>
 #include <numeric>
+#include <optional>
 #include <string_view>
 #include <span>
 #include <fmt/core.h>
@@ -137,6 +140,50 @@ public:
     static std::vector<std::string> split(std::string const& text, char const delimiter) noexcept;
     static std::vector<std::string_view> splitv(std::string_view text, char const delimiter) noexcept;
 
+    /// Podział przysłanego stringa na wektor widoków wg zbioru delimiter'ów. \n
+    /// Zbiór delimiter'ów znany jest w czasie kompilacji (np. splitv<',', ';', '\t'>(text)),
+    /// dzięki czemu tablica rozpoznająca delimitery jest wyznaczana przez kompilator. \n
+    /// Wynik jest taki sam jak dla splitv z jednym delimiter'em.
+    /// \param text - string do podziału,
+    /// \tparam Delimiters - znaki sygnalizujące podział,
+    /// \return Wektor widoków.
+    template<char... Delimiters>
+    static std::vector<std::string_view> splitv(std::string_view text) noexcept {
+        static_assert(sizeof...(Delimiters) > 0, "at least one delimiter is required");
+        if constexpr (sizeof...(Delimiters) == 1)
+            return splitv(text, Delimiters...);
+        else {
+            static constexpr auto table = delimiters_table<Delimiters...>();
+            auto const is_delimiter = [](char const c) {
+                return table[static_cast<u8>(c)];
+            };
+
+            // Lepiej policzyć delimitery niż później realokować wektor.
+            auto const n = std::count_if(text.cbegin(), text.cend(), is_delimiter);
+
+            std::vector<std::string_view> tokens{};
+            tokens.reserve(n + 1);
+
+            auto first = text.cbegin();
+            for (auto it = first; it != text.cend(); ++it)
+                if (is_delimiter(*it)) {
+                    tokens.push_back(trimv_right({first, it}));
+                    first = std::next(it);
+                }
+            if (first != text.cend())
+                tokens.push_back(trimv_right({first, text.cend()}));
+
+            return tokens;
+        }
+    }
+
+    /// Podział przysłanego stringa na wektor widoków wg delimiter'a wieloznakowego (np. "||", "\r\n"). \n
+    /// Wynik jest taki sam jak dla splitv z jednym delimiter'em.
+    /// \param text - string do podziału,
+    /// \param delimiter - ciąg znaków sygnalizujący podział,
+    /// \return Wektor widoków.
+    static std::vector<std::string_view> splitv(std::string_view text, std::string_view delimiter) noexcept;
+
     /// Tworzy string będący złączeniem stringów przysłanych w wektorze. \n
     /// Łączone stringi rozdzielone są przysłanym delimiter'em.
     /// \param data - wektor stringów do połączenia,
@@ -166,6 +213,56 @@ public:
     /// \return string z bajtami
     static std::string bytes_as_str(std::vector<u8> const& data, BytesFormat fmt = BytesFormat::HEX) noexcept;
 
+    /// Kodowanie bajtów w base64 (RFC 4648, z dopełnieniem '='). \n
+    /// Na procesorach z AVX2 używana jest wersja wektorowa (wybierana w czasie działania).
+    /// \param data - bajty do zakodowania,
+    /// \param out - bufor wyjściowy (co najmniej base64_encoded_size(data.size()) znaków),
+    /// \return Tekst base64 lub liczba znaków zapisanych w buforze (brak wartości jeśli bufor jest za mały).
+    static std::string base64_encode(std::span<u8 const> data) noexcept;
+    static std::string base64_encode(std::string_view data) noexcept;
+    static std::optional<size_t> base64_encode(std::span<u8 const> data, std::span<char> out) noexcept;
+    static std::optional<size_t> base64_encode(std::string_view data, std::span<char> out) noexcept;
+
+    /// Kodowanie bajtów w base64url (RFC 4648 §5, bez dopełnienia).
+    /// \param data - bajty do zakodowania,
+    /// \param out - bufor wyjściowy (co najmniej base64url_encoded_size(data.size()) znaków),
+    /// \return Tekst base64url lub liczba znaków zapisanych w buforze (brak wartości jeśli bufor jest za mały).
+    static std::string base64url_encode(std::span<u8 const> data) noexcept;
+    static std::string base64url_encode(std::string_view data) noexcept;
+    static std::optional<size_t> base64url_encode(std::span<u8 const> data, std::span<char> out) noexcept;
+    static std::optional<size_t> base64url_encode(std::string_view data, std::span<char> out) noexcept;
+
+    /// Dekodowanie tekstu base64 (dopełnienie '=' wymagane). \n
+    /// Tekst jest ściśle sprawdzany: tylko znaki alfabetu, poprawne dopełnienie
+    /// i wyzerowane nieużywane bity ostatniego znaku.
+    /// \param text - tekst base64,
+    /// \param out - bufor wyjściowy (co najmniej base64_decoded_size(text) bajtów),
+    /// \return Bajty lub liczba bajtów zapisanych w buforze (brak wartości jeśli tekst jest niepoprawny lub bufor za mały).
+    static std::optional<std::vector<u8>> base64_decode(std::string_view text) noexcept;
+    static std::optional<size_t> base64_decode(std::string_view text, std::span<u8> out) noexcept;
+
+    /// Dekodowanie tekstu base64url (dopełnienie '=' opcjonalne, ale jeśli jest - musi być poprawne).
+    /// \param text - tekst base64url,
+    /// \param out - bufor wyjściowy (co najmniej base64_decoded_size(text) bajtów),
+    /// \return Bajty lub liczba bajtów zapisanych w buforze (brak wartości jeśli tekst jest niepoprawny lub bufor za mały).
+    static std::optional<std::vector<u8>> base64url_decode(std::string_view text) noexcept;
+    static std::optional<size_t> base64url_decode(std::string_view text, std::span<u8> out) noexcept;
+
+    /// Liczba znaków potrzebna do zakodowania n bajtów (base64 z dopełnieniem).
+    static constexpr size_t base64_encoded_size(size_t const n) noexcept {
+        return (n + 2) / 3 * 4;
+    }
+    /// Liczba znaków potrzebna do zakodowania n bajtów (base64url bez dopełnienia).
+    static constexpr size_t base64url_encoded_size(size_t const n) noexcept {
+        return (n * 4 + 2) / 3;
+    }
+    /// Liczba bajtów po zdekodowaniu tekstu (base64 i base64url).
+    static constexpr size_t base64_decoded_size(std::string_view text) noexcept {
+        for (int i = 0; i < 2 && !text.empty() && text.back() == '='; i++)
+            text.remove_suffix(1);
+        return text.size() / 4 * 3 + (text.size() % 4 ? text.size() % 4 - 1 : 0);
+    }
+
     /// Konwersja tekstu na wektor.
     static std::vector<char> str2vec(std::string_view text) noexcept;
 
@@ -187,4 +284,13 @@ public:
         std::chrono::duration<double> const elapsed = end - start;
         return fmt::format("{}s", elapsed.count() / n);
     }
+
+private:
+    /// Tablica (wyznaczana w czasie kompilacji) wskazująca, które znaki są delimiter'ami.
+    template<char... Delimiters>
+    static constexpr std::array<bool, 256> delimiters_table() noexcept {
+        std::array<bool, 256> table{};
+        ((table[static_cast<u8>(Delimiters)] = true), ...);
+        return table;
+    }
 };